@@ -0,0 +1,17 @@
+#!/bin/bash
+
+# Calculate the WENO lists with the decomposition independent cache and
+# compare the written cache with the calculated lists
+
+sed -i "s/^\( *\)globalCache .*/\1globalCache     true;/" system/WENODict
+
+# The lists have to be calculated and not read from an existing cache
+rm -rf constant/WENOBase*
+../src/tests.exe [globalCache]
+result=$?
+
+# Reset to default
+sed -i "s/^\( *\)globalCache .*/\1globalCache     false;/" system/WENODict
+rm -rf constant/WENOBase*
+
+exit ${result}
@@ -0,0 +1,32 @@
+#!/bin/bash
+
+# Compare the time to calculate the least squares matrices for the 
+# different pseudoInverse methods of the WENODict
+
+meshSizes=(50 100 150)
+methods=(SVD lapackSVD QR Cholesky)
+
+echo "# Mesh Size, LS matrix time [s] for: ${methods[@]}" > PLOT/pseudoInverse.dat
+
+for cells in ${meshSizes[@]}; do
+    sed -i "s/^nCells.*/nCells ${cells};/" system/blockMeshDict
+    blockMesh > /dev/null 2>&1 
+
+    line="${cells}"
+    for method in ${methods[@]}; do
+        sed -i "s/^\( *\)pseudoInverse .*/\1pseudoInverse   ${method};/" system/WENODict
+        ../src/tests.exe [2D] > log
+
+        time=$(grep -m1 "Calculated LS matrices in" log | grep -Eo '[0-9]+([.][0-9]+)?([eE][+-]?[0-9]+)?' | head -n1)
+        line="${line}\t${time}"
+    done
+
+    echo -e "${line}" >> PLOT/pseudoInverse.dat
+done
+
+# Reset to default
+sed -i "s/^\( *\)pseudoInverse .*/\1pseudoInverse   SVD;/" system/WENODict
+
+rm log
+
+cat PLOT/pseudoInverse.dat
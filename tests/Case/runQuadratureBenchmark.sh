@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Compare the time of the quadrature of single monomials with gaussQuad and
+# of all monomials of a triangle at once with gaussQuadMoments
+
+echo "# gaussQuad [s], gaussQuadMoments [s] for 10000 triangles up to degree 6" > PLOT/quadrature.dat
+
+../src/tests.exe [quadratureBenchmark] > log
+
+times=$(grep -m1 "gaussQuadMoments:" log | grep -Eo '[0-9]+([.][0-9]+)?([eE][+-]?[0-9]+)?' | head -n2 | tr '\n' '\t')
+
+echo -e "${times}" >> PLOT/quadrature.dat
+
+rm log
+
+cat PLOT/quadrature.dat
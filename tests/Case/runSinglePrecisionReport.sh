@@ -0,0 +1,28 @@
+#!/bin/bash
+
+# Compare the errors of the WENO scheme with the reconstruction matrices
+# stored in double and in single precision
+
+modes=(false true)
+
+echo "# singlePrecision, mean/max error WENO interpolate, mean/max error WENO divergence" > PLOT/singlePrecision.dat
+
+for mode in ${modes[@]}; do
+    sed -i "s/^\( *\)singlePrecision .*/\1singlePrecision ${mode};/" system/WENODict
+    ../src/tests.exe [2D] > log
+
+    meanError=$(grep "Mean Error WENO" log | grep -Eo '[0-9]+([.][0-9]+)?([eE][+-]?[0-9]+)?' | tr '\n' '\t')
+    maxError=$(grep "Max Error WENO" log | grep -Eo '[0-9]+([.][0-9]+)?([eE][+-]?[0-9]+)?' | tr '\n' '\t')
+
+    meanErrors=(${meanError})
+    maxErrors=(${maxError})
+
+    echo -e "${mode}\t${meanErrors[0]}\t${maxErrors[0]}\t${meanErrors[1]}\t${maxErrors[1]}" >> PLOT/singlePrecision.dat
+done
+
+# Reset to default
+sed -i "s/^\( *\)singlePrecision .*/\1singlePrecision false;/" system/WENODict
+
+rm log
+
+cat PLOT/singlePrecision.dat
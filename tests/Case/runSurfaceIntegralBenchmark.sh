@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# Compare the restart time of the WENO lists if the surface integrals are
+# calculated again or loaded from the cache
+
+meshSizes=(50 100 150)
+modes=(false true)
+
+echo "# Mesh Size, restart time [s] with cacheSurfaceIntegrals: ${modes[@]}" > PLOT/surfaceIntegrals.dat
+
+sed -i "s/^\( *\)writeData .*/\1writeData       true;/" system/WENODict
+
+for cells in ${meshSizes[@]}; do
+    sed -i "s/^nCells.*/nCells ${cells};/" system/blockMeshDict
+    blockMesh > /dev/null 2>&1 
+
+    line="${cells}"
+    for mode in ${modes[@]}; do
+        sed -i "s/^\( *\)cacheSurfaceIntegrals .*/\1cacheSurfaceIntegrals ${mode};/" system/WENODict
+
+        # The first run writes the cache, the second run reads it
+        rm -rf constant/WENOBase*
+        ../src/tests.exe [2D] > log
+        ../src/tests.exe [2D] > log
+
+        time=$(grep -m1 "Read WENO lists in" log | grep -Eo '[0-9]+([.][0-9]+)?([eE][+-]?[0-9]+)?' | head -n1)
+        line="${line}\t${time}"
+    done
+
+    echo -e "${line}" >> PLOT/surfaceIntegrals.dat
+done
+
+# Reset to default
+sed -i "s/^\( *\)cacheSurfaceIntegrals .*/\1cacheSurfaceIntegrals false;/" system/WENODict
+sed -i "s/^\( *\)writeData .*/\1writeData       false;/" system/WENODict
+rm -rf constant/WENOBase*
+
+rm log
+
+cat PLOT/surfaceIntegrals.dat